@@ -170,6 +170,21 @@ int buildOnly();
  */
 void interpolateVolumeHex3D(const double * I, double * x, int N, double * Ix, int M);
 
+/**
+ * Interpolate a batch of volumes between NekRS's GLL points and a given-order receiving/sending
+ * mesh. The first pass of the tensor-product interpolation is applied to all of the volumes at
+ * once, and the inner loops run over contiguous data so that they can be vectorized.
+ * @param[in] I interpolation matrix
+ * @param[in] x volume data to be interpolated, stored contiguously for each volume
+ * @param[in] N number of points in 1-D to be interpolated
+ * @param[out] Ix interpolated data, stored contiguously for each volume
+ * @param[in] M resulting number of interpolated points in 1-D
+ * @param[in] n_elems number of volumes to interpolate
+ * @param[in] scratch scratch space of length n_elems * N * N * M + N * M * M
+ */
+void interpolateVolumeHex3D(
+    const double * I, const double * x, int N, double * Ix, int M, int n_elems, double * scratch);
+
 /**
  * Whether nekRS's input file has CHT
  * @return whether nekRS input files model CHT
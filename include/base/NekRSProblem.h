@@ -128,6 +128,13 @@ public:
    */
   unsigned int nUsrWrkSlots() const { return _n_usrwrk_slots; }
 
+  /**
+   * Get the number of bytes of nrs->usrwrk copied to the device in the most recent
+   * data transfer to NekRS
+   * @return bytes copied on this rank
+   */
+  std::size_t usrwrkBytesCopied() const { return _usrwrk_bytes_copied; }
+
   /**
    * Interpolate the NekRS volume solution onto the volume MOOSE mesh mirror (re2 -> mirror)
    * @param[in] f field to interpolate
@@ -154,7 +161,7 @@ public:
     // interpolating)
     double * Ttmp = (double *)calloc(n_to_write, sizeof(double));
     double * Telem = (double *)calloc(start_3d, sizeof(double));
-    auto indices = _nek_mesh->cornerIndices();
+    const auto & indices = _nek_mesh->cornerIndices();
 
     int c = 0;
     for (int k = 0; k < mesh->Nelements; ++k)
@@ -203,7 +210,7 @@ public:
   void boundarySolution(const T & field, double * s)
   {
     mesh_t * mesh = nekrs::entireMesh();
-    auto bc = _nek_mesh->boundaryCoupling();
+    const auto & bc = _nek_mesh->boundaryCoupling();
 
     double (*f)(int, int);
     f = nekrs::solutionPointer(field);
@@ -225,41 +232,38 @@ public:
     double * Tface = (double *)calloc(start_2d, sizeof(double));
     double * scratch = (double *)calloc(start_1d * end_1d, sizeof(double));
 
-    auto indices = _nek_mesh->cornerIndices();
+    const auto & indices = _nek_mesh->cornerIndices();
 
     int c = 0;
-    for (int k = 0; k < bc.total_n_faces; ++k)
+    for (int k = 0; k < bc.n_faces; ++k)
     {
-      if (bc.process[k] == nekrs::commRank())
-      {
-        int i = bc.element[k];
-        int j = bc.face[k];
-        int offset = i * mesh->Nfaces * start_2d + j * start_2d;
+      int i = bc.element[k];
+      int j = bc.face[k];
+      int offset = i * mesh->Nfaces * start_2d + j * start_2d;
 
-        for (int build = 0; build < _nek_mesh->nBuildPerSurfaceElem(); ++build)
+      for (int build = 0; build < _nek_mesh->nBuildPerSurfaceElem(); ++build)
+      {
+        if (_needs_interpolation)
         {
-          if (_needs_interpolation)
+          // get the solution on the face
+          for (int v = 0; v < start_2d; ++v)
           {
-            // get the solution on the face
-            for (int v = 0; v < start_2d; ++v)
-            {
-              int id = mesh->vmapM[offset + v];
-              Tface[v] = f(id, mesh->Nsgeo * (offset + v));
-            }
-
-            // and then interpolate it
-            nekrs::interpolateSurfaceFaceHex3D(
-                scratch, _interpolation_outgoing, Tface, start_1d, &(Ttmp[c]), end_1d);
-            c += end_2d;
+            int id = mesh->vmapM[offset + v];
+            Tface[v] = f(id, mesh->Nsgeo * (offset + v));
           }
-          else
+
+          // and then interpolate it
+          nekrs::interpolateSurfaceFaceHex3D(
+              scratch, _interpolation_outgoing, Tface, start_1d, &(Ttmp[c]), end_1d);
+          c += end_2d;
+        }
+        else
+        {
+          // get the solution on the face - no need to interpolate
+          for (int v = 0; v < end_2d; ++v, ++c)
           {
-            // get the solution on the face - no need to interpolate
-            for (int v = 0; v < end_2d; ++v, ++c)
-            {
-              int id = mesh->vmapM[offset + indices[build][v]];
-              Ttmp[c] = f(id, mesh->Nsgeo * (offset + v));
-            }
+            int id = mesh->vmapM[offset + indices[build][v]];
+            Ttmp[c] = f(id, mesh->Nsgeo * (offset + v));
           }
         }
       }
@@ -278,16 +282,17 @@ public:
   }
 
   /**
-   * Write a mesh displacement into NekRS
-   * @param[in] elem_id element ID
-   * @param[in] s solution values to write for the field for the given element
+   * Write a mesh displacement into NekRS for all of the volume elements on this rank at once,
+   * which lets the interpolation onto the NekRS mesh be batched
+   * @param[in] s solution values to write for the field, stored contiguously for each
+   *              rank-local element
    * @param[in] f which component of the displacement to write
    * @param[in] add optional vector of values to add to each value set on the NekRS end
    */
-  void writeVolumeDisplacement(const int elem_id,
-                               double * s,
-                               const field::NekWriteEnum f,
-                               const std::vector<double> * add = nullptr);
+  void writeLocalVolumeDisplacement(double * s,
+                                    const field::NekWriteEnum f,
+                                    const std::vector<double> * add = nullptr);
+
   /**
    * Write into the NekRS solution space for coupling volumes; for setting a mesh position in terms
    * of a displacement, we need to add the displacement to the initial mesh coordinates. For this,
@@ -303,6 +308,18 @@ public:
                            double * s,
                            const std::vector<double> * add = nullptr);
 
+  /**
+   * Write into the NekRS solution space for all of the coupling volumes on this rank at once,
+   * which lets the interpolation onto the NekRS mesh be batched
+   * @param[in] slot the slot in the usrwrk array to populate
+   * @param[in] s solution values to write for the field, stored contiguously for each
+   *              rank-local element
+   * @param[in] add optional vector of values to add to each value set on the NekRS end
+   */
+  void writeLocalVolumeSolution(const int slot,
+                                double * s,
+                                const std::vector<double> * add = nullptr);
+
   /**
    * Write into the NekRS solution space for coupling boundaries; for setting a mesh position in
    * terms of a displacement, we need to add the displacement to the initial mesh coordinates.
@@ -320,7 +337,7 @@ public:
 
   /**
    * Map nodal points on a MOOSE face element to the GLL points on a Nek face element.
-   * @param[in] e MOOSE element ID
+   * @param[in] e NekRS face ID (must be owned by this rank)
    * @param[in] var_num variable index to fetch MOOSE data from
    * @param[in] divisor number to divide MOOSE data by before sending to Nek (to non-dimensionalize
    * it)
@@ -336,7 +353,7 @@ public:
 
   /**
    * Map nodal points on a MOOSE volume element to the GLL points on a Nek volume element.
-   * @param[in] e MOOSE element ID
+   * @param[in] e NekRS element ID (must be owned by this rank)
    * @param[in] var_num variable index to fetch MOOSE data from
    * @param[in] divisor number to divide MOOSE data by before sending to Nek (to non-dimensionalize
    * it)
@@ -361,7 +378,7 @@ public:
    * looks right now that our biggest expense occurs in the MOOSE transfer system, not these
    * transfers internally to nekRS.
    *
-   * @param[in] e MOOSE element ID
+   * @param[in] e NekRS element ID (must be owned by this rank)
    * @param[in] var_num variable index to fetch MOOSE data from
    * @param[in] divisor number to divide MOOSE data by before sending to Nek (to non-dimensionalize
    * it)
@@ -376,9 +393,23 @@ public:
                               double ** outgoing_data);
 
 protected:
-  /// Copy the data sent from MOOSE->Nek from host to device.
+  /**
+   * Copy the data sent from MOOSE->Nek from host to device, and wait for all of the
+   * asynchronous copies to finish
+   */
   void copyScratchToDevice();
 
+  /**
+   * Record that a range of entries in nrs->usrwrk was modified on the host, so that
+   * only the modified entries are copied to the device
+   * @param[in] begin first modified entry
+   * @param[in] end one past the last modified entry
+   */
+  void markUsrWrkModified(const std::size_t begin, const std::size_t end);
+
+  /// Start asynchronous host to device copies of the modified entries in nrs->usrwrk
+  void copyModifiedScratchToDevice();
+
   /**
    * Interpolate the MOOSE mesh mirror solution onto the NekRS boundary mesh (mirror -> re2)
    * @param[in] incoming_moose_value MOOSE face values
@@ -387,19 +418,91 @@ protected:
   void interpolateBoundarySolutionToNek(double * incoming_moose_value, double * outgoing_nek_value);
 
   /**
-   * Interpolate the MOOSE mesh mirror solution onto the NekRS volume mesh (mirror -> re2)
-   * @param[in] elem_id element ID
-   * @param[in] incoming_moose_value MOOSE face values
-   * @param[out] outgoing_nek_value interpolated MOOSE face values onto the NekRS volume mesh
+   * Write the MOOSE mesh mirror solution for a contiguous range of rank-local volume elements
+   * into a NekRS array, interpolating onto the NekRS volume mesh if needed (mirror -> re2)
+   * @param[out] destination NekRS array, in NekRS's mesh order
+   * @param[in] first first rank-local element to write
+   * @param[in] n_elems number of elements to write
+   * @param[in] s solution values, stored contiguously for each element
+   * @param[in] add optional vector of values to add to each value set on the NekRS end
    */
-  void interpolateVolumeSolutionToNek(const int elem_id,
-                                      double * incoming_moose_value,
-                                      double * outgoing_nek_value);
+  void writeVolumeRange(double * destination,
+                        const int first,
+                        const int n_elems,
+                        const double * s,
+                        const std::vector<double> * add);
+
+  /**
+   * Get the NekRS mesh coordinates for a component of the displacement
+   * @param[in] f which component of the displacement
+   * @return NekRS mesh coordinates
+   */
+  double * coordinates(const field::NekWriteEnum f) const;
 
   /// Initialize interpolation matrices for transfers in/out of nekRS
   void initializeInterpolationMatrices();
 
-  std::unique_ptr<NumericVector<Number>> _serialized_solution;
+  /**
+   * Get the table of auxiliary system dofs of a variable at the mesh mirror nodes, ordered
+   * by rank-local NekRS face (or element), then by mirror element and node. Because the mesh
+   * mirror never changes, each table is built on first use and then re-used for every transfer.
+   * Nodes of mirror elements which are not on this rank's chunk of a distributed mesh hold
+   * DofObject::invalid_id.
+   * @param[in] var_num variable index
+   * @param[in] volume whether to build the table for the volume (true) or boundary mirror
+   * @return gather table
+   */
+  const std::vector<dof_id_type> & gatherTable(const unsigned int var_num, const bool volume);
+
+  /**
+   * Gather and non-dimensionalize the MOOSE data for one NekRS face (or element) from
+   * the localized solution into the NekRS GLL ordering
+   * @param[in] dofs gather table
+   * @param[in] node_index NekRS GLL point for each entry in the gather table for one face/element
+   * @param[in] k rank-local index of the NekRS face (or element)
+   * @param[in] divisor number to divide MOOSE data by
+   * @param[in] additive number to subtract from MOOSE data, before dividing by divisor
+   * @param[out] outgoing_data data represented on Nek's GLL points
+   */
+  void gatherToNek(const std::vector<dof_id_type> & dofs,
+                   const std::vector<int> & node_index,
+                   const int k,
+                   const Real & divisor,
+                   const Real & additive,
+                   double * outgoing_data) const;
+
+  /**
+   * Initialize the ghosted vector holding the auxiliary system dofs read by the incoming
+   * transfers on this rank, and the list of those dofs
+   */
+  void initializeLocalizedSolution();
+
+  /**
+   * Auxiliary solution localized to the dofs read by the incoming transfers on this rank
+   * (the mesh mirror nodes of this rank's NekRS elements)
+   */
+  std::unique_ptr<NumericVector<Number>> _localized_solution;
+
+  /// Auxiliary system dofs to localize into _localized_solution
+  std::vector<dof_id_type> _localized_dofs;
+
+  /// Ranges of entries in nrs->usrwrk modified on the host and not yet copied to the device
+  std::vector<std::pair<std::size_t, std::size_t>> _usrwrk_modified;
+
+  /// Number of bytes of nrs->usrwrk copied to the device in the most recent synchronization
+  std::size_t _usrwrk_bytes_copied = 0;
+
+  /// Gather tables from the boundary mesh mirror to NekRS faces, for each variable
+  std::map<unsigned int, std::vector<dof_id_type>> _face_gather;
+
+  /// Gather tables from the volume mesh mirror to NekRS elements, for each variable
+  std::map<unsigned int, std::vector<dof_id_type>> _volume_gather;
+
+  /// NekRS GLL point for each entry in a face gather table for one NekRS face
+  std::vector<int> _face_gather_index;
+
+  /// NekRS GLL point for each entry in a volume gather table for one NekRS element
+  std::vector<int> _volume_gather_index;
 
   /**
    * Get a three-character prefix for use in writing output files for repeated
@@ -497,6 +600,15 @@ protected:
   /// Vandermonde interpolation matrix (for incoming transfers)
   double * _interpolation_incoming = nullptr;
 
+  /// Number of volume elements interpolated at once for incoming transfers
+  static constexpr int _interpolation_block = 32;
+
+  /// Workspace for the incoming interpolations
+  std::vector<double> _interpolation_scratch;
+
+  /// Incoming data interpolated onto the NekRS GLL points, for one block of elements
+  std::vector<double> _interpolated;
+
   /// For the MOOSE mesh, the number of quadrature points in each coordinate direction
   int _moose_Nq;
 
@@ -21,6 +21,8 @@
 #include "OpenMCProblemBase.h"
 #include "SymmetryPointGenerator.h"
 
+#include "libmesh/threads.h"
+
 /// Tally/filter includes.
 #include "TallyBase.h"
 #include "FilterBase.h"
@@ -119,13 +121,18 @@ public:
   virtual const OpenMCVolumeCalculation * volumeCalculation() const { return _volume_calc; }
 
   /**
-   * Get the mapping of cells to MOOSE elements
-   * @return mapping of cells to MOOSE elements
+   * Get the cells which map to MOOSE elements, ordered by cell index and instance;
+   * the position of a cell in this vector is its cell slot
+   * @return cells which map to MOOSE elements
    */
-  virtual const std::map<cellInfo, std::vector<unsigned int>> & cellToElem() const
-  {
-    return _cell_to_elem;
-  }
+  virtual const std::vector<cellInfo> & mappedCells() const { return _cell_table.cells; }
+
+  /**
+   * Get the elements local to this rank which map to a cell
+   * @param[in] slot cell slot
+   * @return local elements
+   */
+  std::vector<const Elem *> localCellElems(const unsigned int & slot) const;
 
   /**
    * Get the MOOSE subdomains associated with an OpenMC cell
@@ -134,7 +141,10 @@ public:
    */
   virtual std::unordered_set<SubdomainID> getCellToElementSub(const cellInfo & info)
   {
-    return _cell_to_elem_subdomain.at(info);
+    const auto slot = cellSlot(info);
+    return std::unordered_set<SubdomainID>(
+        _cell_table.subdomains.begin() + _cell_table.subdomain_offsets[slot],
+        _cell_table.subdomains.begin() + _cell_table.subdomain_offsets[slot + 1]);
   }
 
   /**
@@ -303,11 +313,12 @@ public:
 
   /**
    * Get the cell index, instance pair from element ID; if the element doesn't map to an OpenMC
-   * cell, the index and instance are both set to UNMAPPED
+   * cell, the index and instance are both set to UNMAPPED. Only elements local to this
+   * rank are stored.
    * @param[in] elem_id element ID
    * @return cell index, instance pair
    */
-  cellInfo elemToCellInfo(const int & elem_id) const { return _elem_to_cell[elem_id]; }
+  cellInfo elemToCellInfo(const int & elem_id) const;
 
   /**
    * Get the fields coupled for each cell; because we require that each cell maps to a consistent
@@ -343,6 +354,18 @@ public:
     return std::find(phase.begin(), phase.end(), cellFeedback(cell_info)) != phase.end();
   }
 
+  /**
+   * Number of cells whose temperature was updated in OpenMC in the most recent transfer
+   * @return number of cells with updated temperatures
+   */
+  unsigned int nTemperatureUpdates() const { return _n_temperature_updates; }
+
+  /**
+   * Number of cells whose density was updated in OpenMC in the most recent transfer
+   * @return number of cells with updated densities
+   */
+  unsigned int nDensityUpdates() const { return _n_density_updates; }
+
   /**
    * Checks if the [Problem/Filters] block contains a specific filter.
    * @param[in] filter_name the MOOSE object name of the filter
@@ -387,7 +410,10 @@ public:
    */
   double cellMappedVolume(const cellInfo & cell_info) const;
 
-  /// Reconstruct the DAGMC geometry after skinning
+  /**
+   * Reconstruct the DAGMC universe after skinning, only finalizing the new DAGMC cells and
+   * re-loading cross sections if the new cells are filled by materials not previously in use
+   */
   void reloadDAGMC();
 
   /**
@@ -460,6 +486,9 @@ public:
   /// Spatial dimension of the Monte Carlo problem
   static constexpr int DIMENSION{3};
 
+  /// Version of the format of the 'mapping_cache' file
+  static constexpr int MAPPING_CACHE_VERSION{2};
+
   /// Get a modifyable non-const reference to the Moose mesh
   virtual MooseMesh & getMooseMesh();
 
@@ -503,6 +532,30 @@ protected:
    */
   void reinitCouplingAndApplyFeedback();
 
+  /**
+   * Re-interpolate the multi-group cross sections in temperature after new temperatures
+   * have been applied to OpenMC. The nuclide data read from the library is kept in memory,
+   * and the library is only read again when a temperature requires data that is not resident.
+   * Otherwise, only the macroscopic cross sections of materials whose temperatures changed
+   * are rebuilt.
+   */
+  void updateMGXS();
+
+  /// Read the temperatures (K) available for each nuclide in the multi-group library
+  void readMGXSLibraryTemperatures();
+
+  /**
+   * Get the library temperatures which OpenMC reads to represent a set of temperatures,
+   * following the temperature method and tolerance in the OpenMC settings
+   * @param[in] available temperatures in the library, sorted
+   * @param[in] temperatures temperatures needed by the model
+   * @param[out] to_read sorted, unique library temperatures
+   * @return whether all temperatures can be represented by the library
+   */
+  bool mgxsTemperaturesToRead(const std::vector<double> & available,
+                              const std::vector<double> & temperatures,
+                              std::vector<double> & to_read) const;
+
   /**
    * Implement critSearchStep() to re-generate the cell-to-element (and dual)
    * mapping. This sends new temperatures and densities to OpenMC from the
@@ -569,10 +622,14 @@ protected:
   bool cellMapsToSubdomain(const cellInfo & cell_info,
                            const std::unordered_set<SubdomainID> & id) const;
 
+  /// Skin the mesh and delete the OpenMC DAGMC geometry
+  void updateOpenMCGeometry();
+
   /**
-   * Delete the OpenMC DAGMC geometry and re-generate the CSG geometry data structures in-place.
+   * Delete the OpenMC DAGMC cells and surfaces in-place in linear time, preserving the
+   * indices of the CSG surfaces
    */
-  void updateOpenMCGeometry();
+  void removeDAGMCGeometry();
 
   /**
    * Get a list of each material in the problem, sorted by subdomain. This function also checks
@@ -625,23 +682,27 @@ protected:
   std::set<SubdomainID> coupledSubdomains() const;
 
   /**
-   * Gather a vector of values to be summed for each cell
-   * @param[in] local local values to be summed for the cells
-   * @param[out] global global mapping of the summed values to the cells
+   * Sum values for each cell across ranks
+   * @param[in,out] values local values on input and global sums on output, indexed by cell slot
    */
   template <typename T>
-  void gatherCellSum(std::vector<T> & local, std::map<cellInfo, T> & global) const;
+  void gatherCellSum(std::vector<T> & values) const;
 
   /**
-   * Gather a vector of values to be pushed back to for each cell
+   * Gather a vector of values to be pushed back to for each cell, in compressed sparse
+   * row form. Values are ordered by rank, then by the order in which they were contributed.
    * @param[in] local local values to be pushed back for the cells
-   * @param[in] n_local number of local values contributed to each cell
-   * @param[out] global global mapping of the pushed back values to the cells
+   * @param[in] n_local number of local values contributed to each cell with local elements
+   * @param[out] offsets offsets into 'global' for each cell slot
+   * @param[out] global values for all cells
+   * @param[in] root_only whether to only gather onto the root rank (other ranks get no values)
    */
   template <typename T>
   void gatherCellVector(std::vector<T> & local,
                         std::vector<unsigned int> & n_local,
-                        std::map<cellInfo, std::vector<T>> & global);
+                        std::vector<unsigned int> & offsets,
+                        std::vector<T> & global,
+                        const bool root_only = false) const;
 
   /**
    * Get the feedback which this element provides to OpenMC
@@ -670,6 +731,12 @@ protected:
    */
   void cacheContainedCells();
 
+  /**
+   * Flatten the cached contained cells into the cell table, looking up the identical
+   * fill instance shifts once so that feedback can be sent without searching the maps
+   */
+  void flattenContainedCells();
+
   /**
    * Fill the cached contained cells data structure for a given cell
    * @param[in] cell_info cell index, instance pair
@@ -732,9 +799,61 @@ protected:
   /// Set up the mapping from MOOSE elements to OpenMC cells
   void initializeElementToCellMapping();
 
+  /**
+   * Update the mapping from MOOSE elements to OpenMC cells by only re-mapping the elements
+   * which changed since the previous mapping. This is only possible if the OpenMC geometry
+   * itself did not change.
+   * @return whether the mapping could be updated incrementally
+   */
+  bool updateElementToCellMapping();
+
+  /// Fill the local to global element mapping with the active local elements
+  void setLocalElems();
+
   /// Populate maps of MOOSE elements to OpenMC cells
   void mapElemsToCells();
 
+  /**
+   * Classify the located local elements in _local_elem_search and gather the
+   * mapping of cells to elements onto all ranks
+   */
+  void storeElemToCellMapping();
+
+  /**
+   * Get the subdomains on which a cell tally requires elements to be mapped to cells
+   * @return cell tally subdomains
+   */
+  std::set<SubdomainID> cellTallyBlocks() const;
+
+  /**
+   * Compute the key which identifies a cached mapping; this hashes the [Mesh] (as seen
+   * by OpenMC), the OpenMC geometry files, and the settings which influence the mapping
+   * @return cache key
+   */
+  std::string mappingCacheKey() const;
+
+  /**
+   * Read the mapping from the 'mapping_cache' file, if it exists and matches the key
+   * @param[in] key cache key for the present problem
+   * @return whether the mapping was read from the cache
+   */
+  bool readMappingCache(const std::string & key);
+
+  /**
+   * Write the mapping to the 'mapping_cache' file
+   * @param[in] key cache key for the present problem
+   */
+  void writeMappingCache(const std::string & key) const;
+
+  /**
+   * Populate maps of MOOSE elements to OpenMC cells, only searching for a subset of the
+   * local elements; all other local elements keep their entry in _local_elem_search
+   * @param[in] local_elems local element indices to search
+   * @param[in] cell_stacks particles located in previously-mapped cells
+   */
+  void mapElemsToCells(const std::vector<unsigned int> & local_elems,
+                       const std::map<cellInfo, std::unique_ptr<openmc::Particle>> & cell_stacks);
+
   /**
    * A function which validates local tallies. This is done to ensure that at least one of the
    * tallies contains a heating score when running in eigenvalue mode. This must be done outside
@@ -759,14 +878,15 @@ protected:
   void getPointInCell();
 
   /**
-   * Compute the product of volume with a field across ranks and sum into a global map
-   * @param[in] var_num variable to weight with volume, mapped by subdomain ID
+   * Compute the product of volume with a field across ranks and sum into a global map;
+   * only the locally-owned entries of the auxiliary solution are read
+   * @param[in] dofs degree of freedom of the field for each entry in _cell_table.local_elems
    * @param[in] phase phases to compute the operation for
    * @param[in] scaling a scaling factor to apply, mapped by subdomain ID
-   * @return volume-weighted field for each cell, in a global sense
+   * @return volume-weighted field for each cell slot, in a global sense
    */
-  std::map<cellInfo, Real> computeVolumeWeightedCellInput(
-      const std::map<SubdomainID, std::pair<unsigned int, std::string>> & var_num,
+  std::vector<Real> computeVolumeWeightedCellInput(
+      const std::vector<dof_id_type> & dofs,
       const std::vector<coupling::CouplingFields> * phase = nullptr,
       const std::map<SubdomainID, Real> * scaling = nullptr) const;
 
@@ -774,13 +894,46 @@ protected:
    * Send temperature from MOOSE to OpenMC by computing a volume average
    * and applying a single temperature per OpenMC cell
    */
-  void sendTemperatureToOpenMC() const;
+  void sendTemperatureToOpenMC();
 
   /**
    * Send density from MOOSE to OpenMC by computing a volume average
    * and applying a single density per OpenMC cell.
    */
-  void sendDensityToOpenMC() const;
+  void sendDensityToOpenMC();
+
+  /// A single property update to apply to one instance of a material cell in OpenMC
+  struct CellUpdate
+  {
+    /// Index of the material cell in the openmc::model::cells array
+    int32_t index;
+
+    /// Instance of the material cell
+    int32_t instance;
+
+    /// Temperature (K) or density (kg/m3) to set
+    Real value;
+
+    /// Slot of the coupled cell containing this material cell
+    unsigned int slot;
+  };
+
+  /**
+   * Append updates for all of the material cells contained in a coupled cell
+   * @param[in] slot slot of the coupled cell
+   * @param[in] value temperature or density to set
+   * @param[out] updates list of updates
+   */
+  void addCellUpdates(unsigned int slot, Real value, std::vector<CellUpdate> & updates) const;
+
+  /**
+   * Apply a list of temperature or density updates to OpenMC cells, threaded over the
+   * updates. Errors are reported after all threads have finished.
+   * @param[in] updates list of updates
+   * @param[in] field whether to set temperature or density
+   */
+  void applyCellUpdates(const std::vector<CellUpdate> & updates,
+                        const coupling::CouplingFields field) const;
 
   /**
    * Check if a mapped location is in the outer universe of a lattice
@@ -789,6 +942,14 @@ protected:
    */
   void latticeOuterCheck(const Point & c, int level) const;
 
+  /**
+   * Whether a located particle is in the outer universe of a lattice
+   * @param[in] p particle which has already been located in the geometry
+   * @param[in] level lattice level
+   * @return whether the location is in the outer universe
+   */
+  bool inLatticeOuterUniverse(const openmc::Particle & p, int level) const;
+
   /**
    * Report an error for a mapped location in an outer universe of a lattice
    * @param[in] c Mapped location
@@ -803,6 +964,204 @@ protected:
    */
   bool findCell(const Point & point);
 
+  /**
+   * Find the OpenMC cell at a given point in space, using the provided particle
+   * @param[in] p particle to use for the search
+   * @param[in] point point
+   * @return whether OpenMC reported an error
+   */
+  bool findCell(openmc::Particle & p, const Point & point) const;
+
+  /// Result of searching for the OpenMC cell at the centroid of a single local element
+  struct ElemCellSearch
+  {
+    /// Cell index and instance at the level used for mapping
+    cellInfo cell_info{UNMAPPED, UNMAPPED};
+
+    /// Element centroid
+    Point centroid;
+
+    /// Element subdomain
+    SubdomainID subdomain{Moose::INVALID_BLOCK_ID};
+
+    /// Element volume
+    Real volume{0.0};
+
+    /// Type of feedback the element provides
+    coupling::CouplingFields phase{coupling::none};
+
+    /// Whether OpenMC found a cell at the element centroid
+    bool found{false};
+
+    /// Whether the element needs to be stored in the cell to element mapping
+    bool requires_mapping{false};
+
+    /// Whether the requested coupling level is deeper than the geometry at the centroid
+    bool exceeds_levels{false};
+
+    /// Whether the mapped cell is in the outer universe of a lattice
+    bool in_lattice_outer{false};
+
+    /// Whether the search was resolved by the coordinate stack of the previous element
+    bool hint_hit{false};
+  };
+
+  /**
+   * Coupling data for the mapped cells, stored as a struct of arrays indexed by a dense
+   * cell slot. Slots are ordered by cell index and instance, and are identical on all ranks.
+   * Element and subdomain lists are stored in compressed sparse row form, where the entries
+   * for slot i are [offsets[i], offsets[i + 1]). Only the elements local to each rank are
+   * stored, so per-cell values are communicated by reductions over the slots.
+   */
+  struct CellTable
+  {
+    /// Cell index and instance in each slot
+    std::vector<cellInfo> cells;
+
+    /// Offsets into 'local_elems' for each slot
+    std::vector<unsigned int> local_offsets;
+
+    /// Local element indices mapped to each slot (empty for cells with no local elements)
+    std::vector<unsigned int> local_elems;
+
+    /// Volume of the mapped [Mesh] elements, in the units of the [Mesh]
+    std::vector<Real> volume;
+
+    /// Number of temperature-only feedback elements (global)
+    std::vector<int> n_temp;
+
+    /// Number of density-only feedback elements (global)
+    std::vector<int> n_rho;
+
+    /// Number of temperature+density feedback elements (global)
+    std::vector<int> n_temp_rho;
+
+    /// Number of uncoupled elements (global)
+    std::vector<int> n_none;
+
+    /// Temperature variable degree of freedom for each entry in 'local_elems'
+    std::vector<dof_id_type> temp_dofs;
+
+    /// Density variable degree of freedom for each entry in 'local_elems'
+    std::vector<dof_id_type> density_dofs;
+
+    /// Temperature most recently sent to OpenMC for each cell (NaN if never sent)
+    std::vector<Real> sent_temperature;
+
+    /// Density most recently sent to OpenMC for each cell (NaN if never sent)
+    std::vector<Real> sent_density;
+
+    /// Type of feedback each cell receives
+    std::vector<coupling::CouplingFields> phase;
+
+    /**
+     * A point inside the cell, taken simply as the centroid of the first element
+     * on the lowest rank inside the cell. This is stored to accelerate the particle search.
+     */
+    std::vector<Point> point;
+
+    /// Offsets into 'subdomains' for each slot
+    std::vector<unsigned int> subdomain_offsets;
+
+    /// Unique, sorted subdomains that each cell maps to
+    std::vector<SubdomainID> subdomains;
+
+    /// Number of material-type cells contained within each cell
+    std::vector<int32_t> n_contained;
+
+    /// Offsets into 'contained' for each slot
+    std::vector<unsigned int> contained_offsets;
+
+    /// Material cells contained within each cell (empty for cells with an identical fill)
+    std::vector<cellInfo> contained;
+
+    /// Multiple of the identical fill instance shifts for each slot (-1 if not an identical fill)
+    std::vector<int32_t> identical_fill_offset;
+
+    /// Material cells contained within the first cell with an identical fill
+    std::vector<cellInfo> identical_contained;
+
+    /// Instance shift between successive identical fills for each entry in 'identical_contained'
+    std::vector<int32_t> identical_shifts;
+
+    /// Number of local elements in a slot
+    unsigned int nLocalElems(unsigned int slot) const
+    {
+      return local_offsets[slot + 1] - local_offsets[slot];
+    }
+
+    /// Approximate heap memory held by the table, in bytes
+    std::size_t memoryUsage() const;
+  };
+
+  /**
+   * Store the degrees of freedom of the temperature and density feedback variables for
+   * each local element in the cell table
+   */
+  void cacheFeedbackDofs();
+
+  /**
+   * Get the dense slot of a mapped cell in _cell_table
+   * @param[in] cell_info cell index, instance pair
+   * @return slot, or UNMAPPED if the cell does not map to the [Mesh]
+   */
+  int cellSlot(const cellInfo & cell_info) const;
+
+  /**
+   * Print the memory held by the cell to element coupling data, alongside an estimate
+   * of the memory that the equivalent node-based (map) containers would require
+   */
+  void printMappingMemory() const;
+
+  /**
+   * Find the OpenMC cells for a contiguous range of local elements; this is called
+   * from multiple threads, so errors are only flagged here and reported afterwards.
+   * Elements which were previously mapped to a cell in 'cell_stacks' keep their
+   * mapping if their centroid is still inside that cell.
+   * @param[in] range range of indices into 'local_elems'
+   * @param[in] local_elems local element indices to search
+   * @param[in] cell_tally_blocks subdomains on which a cell tally requires a mapping
+   * @param[in] cell_stacks particles located in previously-mapped cells
+   * @param[in,out] search search result for each local element
+   */
+  void searchElemCells(const Threads::BlockedRange<std::size_t> & range,
+                       const std::vector<unsigned int> & local_elems,
+                       const std::set<SubdomainID> & cell_tally_blocks,
+                       const std::map<cellInfo, std::unique_ptr<openmc::Particle>> & cell_stacks,
+                       std::vector<ElemCellSearch> & search) const;
+
+  /**
+   * Coordinate level down to which a located particle can be re-used as a hint for
+   * the search of a nearby point. Only levels which are related to the global
+   * coordinates by a pure translation can be checked, so lattices and rotated fills
+   * disable the hint.
+   * @param[in] p particle which has already been located in the geometry
+   * @return deepest level to check, or -1 if the particle cannot be used as a hint
+   */
+  int searchHintLevel(const openmc::Particle & p) const;
+
+  /**
+   * Whether a point is contained in the same cells as a previously located particle
+   * on every coordinate level down to (and including) the given level
+   * @param[in] p particle which has already been located in the geometry
+   * @param[in] r point, in OpenMC's coordinates
+   * @param[in] level deepest level to check
+   * @return whether the point lies in the same cells
+   */
+  bool cellStackContains(const openmc::Particle & p, const openmc::Position & r, int level) const;
+
+  /**
+   * Finish locating a point with a particle whose coordinate stack down to the given level
+   * is already known to contain the point, by searching the levels below it in the same way
+   * as a search from the root universe would. This ensures that points in voids or in
+   * different cells of the lower levels are treated exactly as a full search would.
+   * @param[in,out] p particle holding the known coordinate stack, which is moved to the point
+   * @param[in] r point, in OpenMC's coordinates
+   * @param[in] level deepest level known to contain the point (from searchHintLevel)
+   * @return whether the point was located in a cell
+   */
+  bool findCellBelowLevel(openmc::Particle & p, const openmc::Position & r, int level) const;
+
   /**
    * Checks that the contained material cells exactly match between a reference obtained
    * by calling openmc::Cell::get_contained_cells for each cell and a shortcut
@@ -820,9 +1179,6 @@ protected:
    */
   virtual std::vector<int32_t> getMappedTallyIDs() const override;
 
-  /// A reference to the serialized auxvariable solution.
-  NumericVector<Number> & _serialized_solution;
-
   /**
    * Whether to automatically compute the mapping of OpenMC cell IDs and
    * instances to the [Mesh].
@@ -871,6 +1227,19 @@ protected:
    */
   bool _need_to_reinit_coupling;
 
+  /**
+   * When re-initializing the coupling, whether to only re-map the elements which were
+   * refined, coarsened, or moved out of their previously-mapped cell, instead of re-building
+   * the entire mapping from scratch
+   */
+  const bool _incremental_remap;
+
+  /// Whether the 'mapping_cache' should be read or written during the next setup
+  bool _check_mapping_cache;
+
+  /// Whether the present mapping was read from the 'mapping_cache'
+  bool _mapping_from_cache{false};
+
   /**
    * If known a priori by the user, whether the tally cells (which are not simply material
    * fills) have EXACTLY the same contained material cells. This is a big optimization for
@@ -940,6 +1309,18 @@ protected:
    */
   const bool _specified_temperature_feedback;
 
+  /// Cells whose temperature changed by less than this since the last transfer are not updated
+  const Real & _temperature_update_tol;
+
+  /// Cells whose density changed by less than this since the last transfer are not updated
+  const Real & _density_update_tol;
+
+  /// Number of cells whose temperature was updated in the most recent transfer
+  unsigned int _n_temperature_updates{0};
+
+  /// Number of cells whose density was updated in the most recent transfer
+  unsigned int _n_density_updates{0};
+
   /// Whether any cell tallies exist.
   bool _has_cell_tallies = false;
 
@@ -976,12 +1357,6 @@ protected:
   /// Blocks for which the cell fills are identical
   std::unordered_set<SubdomainID> _identical_cell_fill_blocks;
 
-  /// Mapping of MOOSE elements to the OpenMC cell they map to (if any)
-  std::vector<cellInfo> _elem_to_cell{};
-
-  /// Phase of each cell
-  std::map<cellInfo, coupling::CouplingFields> _cell_phase;
-
   /// Number of elements in the MOOSE mesh that exclusively provide density feedback
   int _n_moose_density_elems;
 
@@ -1021,29 +1396,29 @@ protected:
   /// Whether non-material cells are mapped
   bool _material_cells_only{true};
 
-  /// Mapping of OpenMC cell indices to a vector of MOOSE element IDs
-  std::map<cellInfo, std::vector<unsigned int>> _cell_to_elem;
+  /// Time (s) spent searching for the cells mapped to each element, max over ranks
+  Real _mapping_search_time;
 
-  /// Mapping of OpenMC cell indices to a vector of MOOSE element IDs, on each local rank
-  std::map<cellInfo, std::vector<unsigned int>> _local_cell_to_elem;
+  /// Time (s) spent classifying the located elements, max over ranks
+  Real _mapping_classify_time;
 
-  /// Mapping of OpenMC cell indices to the subdomain IDs each maps to
-  std::map<cellInfo, std::unordered_set<SubdomainID>> _cell_to_elem_subdomain;
+  /// Time (s) spent communicating the element to cell mapping, max over ranks
+  Real _mapping_communication_time;
 
-  /// Mapping of elem subdomains to materials
-  std::map<SubdomainID, std::set<int32_t>> _subdomain_to_material;
+  /// Number of element cell searches resolved by the previous element's coordinate stack
+  unsigned int _n_mapping_hint_hits;
 
-  /**
-   * A point inside the cell, taken simply as the centroid of the first global
-   * element inside the cell. This is stored to accelerate the particle search.
-   */
-  std::map<cellInfo, Point> _cell_to_point;
+  /// Number of element cell searches performed
+  unsigned int _n_mapping_searches;
 
-  /**
-   * Volume associated with the mapped element space for each OpenMC cell; the unit
-   * for this volume is whatever is used in the [Mesh] block
-   */
-  std::map<cellInfo, Real> _cell_to_elem_volume;
+  /// Per-cell coupling data, indexed by cell slot
+  CellTable _cell_table;
+
+  /// Cell search result for each local element, indexed by local element index
+  std::vector<ElemCellSearch> _local_elem_search;
+
+  /// Mapping of elem subdomains to materials
+  std::map<SubdomainID, std::set<int32_t>> _subdomain_to_material;
 
   /**
    * Volume associated with the actual OpenMC cell, computed by an optional
@@ -1057,9 +1432,6 @@ protected:
    */
   std::map<cellInfo, containedCells> _cell_to_contained_material_cells;
 
-  /// Number of material-type cells contained within a cell
-  std::map<cellInfo, int32_t> _cell_to_n_contained;
-
   /// Whether the present transfer is the first transfer
   static bool _first_transfer;
 
@@ -1087,18 +1459,6 @@ protected:
   /// Userobject that maps from a partial-symmetry OpenMC model to a whole-domain [Mesh]
   const SymmetryPointGenerator * _symmetry;
 
-  /// Number of temperature-only feedback elements in each mapped OpenMC cell (global)
-  std::map<cellInfo, int> _n_temp;
-
-  /// Number of density-only feedback elements in each mapped OpenMC cell (global)
-  std::map<cellInfo, int> _n_rho;
-
-  /// Number of temperature+density feedback elements in each mapped OpenMC cell (global)
-  std::map<cellInfo, int> _n_temp_rho;
-
-  /// Number of none elements in each mapped OpenMC cell (global)
-  std::map<cellInfo, int> _n_none;
-
   /// The tally to be used for normalizing all other tallies when running an eigenvalue calculation.
   std::shared_ptr<TallyBase> _source_rate_norm_tally;
 
@@ -1125,9 +1485,8 @@ protected:
   /// ID of the OpenMC cell corresponding to the cell which uses the DAGMC universe as a fill.
   int32_t _cell_using_dagmc_universe_id;
 
-  /// The number of OpenMC surfaces before skinning occurs. This is required to properly reinitialize
-  /// the CSG geometry contained in the OpenMC model.
-  const int32_t _initial_num_openmc_surfaces;
+  /// Whether each OpenMC material filled a cell before the DAGMC geometry was last removed
+  std::vector<bool> _material_in_geometry;
 
   /// Conversion rate from eV to Joule
   static constexpr Real EV_TO_JOULE = 1.6022e-19;
@@ -1141,12 +1500,6 @@ private:
    */
   void dufekGudowskiParticleUpdate();
 
-  /// Flattened cell IDs collected after parallel communication
-  std::vector<int32_t> _flattened_ids;
-
-  /// Flattened cell instancess collected after parallel communication
-  std::vector<int32_t> _flattened_instances;
-
   /// Offsets for each cell instance in an identically-repeated universe
   containedCells _instance_offsets;
 
@@ -1171,6 +1524,18 @@ private:
   /// Mapping from subdomain IDs to the reference density (kg/m3).
   std::map<SubdomainID, Real> _subdomain_to_ref_density;
 
+  /// Temperatures (K) available in the multi-group library for each nuclide
+  std::vector<std::vector<double>> _mgxs_library_temps;
+
+  /// Library temperatures (K) currently held in memory for each nuclide
+  std::vector<std::vector<double>> _mgxs_resident_temps;
+
+  /// Model temperatures (K) for which the library data in memory was read, for each nuclide
+  std::vector<std::vector<double>> _mgxs_requested_temps;
+
+  /// Temperatures (eV) used to build the macroscopic cross sections of each material
+  std::vector<std::vector<double>> _mgxs_material_kTs;
+
   /// Mapping from cell index to the OpenMC Cell Material Modifier that contains its material list
   std::map<int32_t, OpenMCCellMaterialFill *> _cell_material_modifiers;
 };
@@ -321,6 +321,27 @@ public:
    */
   void writeSourceBank(const std::string & filename);
 
+  /**
+   * Save the source bank from the latest OpenMC solve for use as the starting source of the
+   * next solve, writing it to file for a checkpoint
+   */
+  void saveSourceBank();
+
+  /**
+   * Start the next OpenMC run from the source bank of the latest run, keeping the replaced
+   * external sources until restoreExternalSources()
+   */
+  void startFromSourceBank();
+
+  /// Restore the external sources replaced by startFromSourceBank()
+  void restoreExternalSources();
+
+  /**
+   * Gather the full source bank from the latest OpenMC run onto every rank
+   * @param[out] sites source sites, in the same order as in an OpenMC source file
+   */
+  void globalSourceBank(std::vector<openmc::SourceSite> & sites) const;
+
   /**
    * Get the total (i.e. summed across all ranks, if distributed)
    * number of elements in a given block
@@ -496,6 +517,15 @@ protected:
    */
   bool _reuse_source;
 
+  /// Interval (in OpenMC solves) at which to write the re-used source to file; zero for never
+  const unsigned int _source_checkpoint_interval;
+
+  /// Source bank from the previous OpenMC solve
+  std::vector<openmc::SourceSite> & _source_bank;
+
+  /// External sources replaced by startFromSourceBank()
+  std::vector<std::unique_ptr<openmc::Source>> _replaced_sources;
+
   /// Whether a mesh scaling was specified by the user
   const bool _specified_scaling;
 
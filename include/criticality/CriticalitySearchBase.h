@@ -59,6 +59,34 @@ protected:
   /// Assumed units in the input quantities
   virtual std::string units() const = 0;
 
+  /**
+   * Find a narrow bracket around the root by taking secant steps from the previous critical
+   * value with the previous worth, falling back to the full range if k does not cross the
+   * target within a few steps
+   * @param[in] func function to find the root of
+   * @param[out] lower lower end of the bracket
+   * @param[out] upper upper end of the bracket
+   */
+  void warmStartBracket(const std::function<Real(Real)> & func, Real & lower, Real & upper) const;
+
+  /**
+   * Find the closest pair of evaluations in the current search on either side of the target
+   * @param[in] first index of the first evaluation in the current search
+   * @param[out] a index of the evaluation on one side of the target
+   * @param[out] b index of the evaluation on the other side of the target
+   * @return whether the target has been bracketed
+   */
+  bool tightestBracket(std::size_t first, std::size_t & a, std::size_t & b) const;
+
+  /**
+   * Number of particles to use for the next evaluation, such that the 3-sigma standard
+   * deviation in k is smaller than the expected distance of k from the target
+   * @param[in] first index of the first evaluation in the current search
+   * @param[in] n_full number of particles for the converged evaluations
+   * @return number of particles
+   */
+  int64_t searchParticles(std::size_t first, int64_t n_full) const;
+
   /// Maximum range of value to explore
   const Real & _maximum;
 
@@ -83,6 +111,27 @@ protected:
   /// Target k
   const Real & _target;
 
+  /// Whether to start each search from the previous critical value and worth
+  const bool & _warm_start;
+
+  /// Minimum fraction of the particles to use for the evaluations in the search
+  const Real & _min_particles_fraction;
+
+  /// Whether to start each evaluation from the fission source of the previous evaluation
+  const bool & _reuse_search_source;
+
+  /// Whether a previous search has converged, to warm start from
+  bool _has_previous_search;
+
+  /// Critical value from the previous search
+  Real _previous_root;
+
+  /// Worth (change in k per unit of the input) near the root from the previous search
+  Real _previous_worth;
+
+  /// Number of particles used for each value in search
+  std::vector<int64_t> _particles;
+
   /// Values used in search
   std::vector<Real> _inputs;
 
@@ -94,4 +143,7 @@ protected:
 
   /// Postprocessor that holds the result of the criticality search
   const std::string _pp_name = "critical_value";
+
+  /// Postprocessor that holds the number of OpenMC runs used by the criticality search
+  const std::string _runs_pp_name = "critical_search_runs";
 };
@@ -20,11 +20,16 @@
 
 #include "CardinalUtils.h"
 
+#include <algorithm>
+#include <vector>
+
 /**
  * Store the geometry and parallel information related to the surface mesh coupling.
  * Unless otherwise noted, all information in here is indexed according to the
  * NekRS mesh, and *not* the mesh mirror (this is only relevant for 'exact' mesh mirrors,
- * where we build N^2 or N^3 MOOSE elements for each NekRS element).
+ * where we build N^2 or N^3 MOOSE elements for each NekRS element). Only the faces
+ * owned by this rank are stored, which are the global faces offset, offset + 1, ...,
+ * offset + n_faces - 1 (faces are numbered by owning rank).
  */
 class NekBoundaryCoupling
 {
@@ -34,32 +39,35 @@ public:
    * @param[in] elem_id element ID
    * @return nekRS process ID
    */
-  int processor_id(const int elem_id) const { return process[elem_id]; }
+  int processor_id(const int elem_id) const
+  {
+    return std::upper_bound(offsets.begin(), offsets.end(), elem_id) - offsets.begin() - 1;
+  }
 
-  // process-local element IDS on the boundary of interest (for all ranks)
+  // process-local element IDS on the boundary of interest (for this rank's faces)
   std::vector<int> element;
 
-  // element-local face IDs on the boundary of interest (for all ranks)
+  // element-local face IDs on the boundary of interest (for this rank's faces)
   std::vector<int> face;
 
-  // problem-global boundary ID for each element (for all ranks)
+  // problem-global boundary ID for each face (for this rank's faces)
   std::vector<int> boundary_id;
 
-  // process owning each face (for all faces)
-  std::vector<int> process;
-
   // number of faces owned by each process
   std::vector<int> counts;
 
   // number of MOOSE mirror faces owned by each process
   std::vector<int> mirror_counts;
 
+  // global ID of the first face owned by each process, followed by the total number of faces
+  std::vector<int> offsets;
+
   // number of coupling elements owned by this process
   int n_faces = 0;
 
   // total number of coupling elements
   int total_n_faces = 0;
 
-  // offset into the element, face, and process arrays where this rank's data begins
+  // global ID of the first face owned by this process
   int offset = 0;
 };
@@ -290,7 +290,7 @@ public:
 
   /**
    * Get the number of faces of this global element that are on a coupling boundary
-   * @param[in] elem_id global element ID
+   * @param[in] elem_id global element ID (must be owned by this rank)
    * @return number of faces on a coupling boundary
    */
   int facesOnBoundary(const int elem_id) const;
@@ -305,7 +305,7 @@ public:
    * Get the corner indices for the GLL points to be used in the mesh mirror
    * @return mapping of mesh mirror nodes to GLL points
    */
-  std::vector<std::vector<int>> cornerIndices() const { return _corner_indices; }
+  const std::vector<std::vector<int>> & cornerIndices() const { return _corner_indices; }
 
   /**
    * Get the number of MOOSE elements we build for each NekRS element
@@ -322,23 +322,15 @@ public:
   void updateDisplacement(const int e, const double * src, const field::NekWriteEnum field);
 
 protected:
-  /// Store the rank-local element and rank ownership for volume coupling
+  /// Store the rank-local sidesets and global element counts for volume coupling
   void storeVolumeCoupling();
 
   /**
-   * Store the rank-local element and rank ownership for boundary coupling;
+   * Store the rank-local elements/faces and global face counts for boundary coupling;
    * this loops over the NekRS mesh and fetches relevant information on the boundaries
    */
   void storeBoundaryCoupling();
 
-  /**
-   * Sideset ID corresponding to a given volume element with give local face ID
-   * @param[in] elem_id element local rank ID
-   * @param[in] face_id element-local face ID
-   * @return sideset ID (-1 means not one a boundary)
-   */
-  int boundary_id(const int elem_id, const int face_id);
-
   /**
    * Get the vertices defining the surface mesh interpolation from the
    * stored coupling information and store in _x, _y, and _z
@@ -20,11 +20,16 @@
 
 #include "CardinalUtils.h"
 
+#include <algorithm>
+#include <vector>
+
 /**
  * Store the geometry and parallel information related to the volume mesh coupling.
  * Unless otherwise noted, all information in here is indexed according to the
  * NekRS mesh, and *not* the mesh mirror (this is only relevant for 'exact' mesh mirrors,
- * where we build N^2 or N^3 MOOSE elements for each NekRS element).
+ * where we build N^2 or N^3 MOOSE elements for each NekRS element). Only the elements
+ * owned by this rank are stored; the global element offset + i is the process-local
+ * element i (elements are numbered by owning rank).
  */
 class NekVolumeCoupling
 {
@@ -34,15 +39,12 @@ public:
    * @param[in] elem_id element ID
    * @return nekRS process ID
    */
-  int processor_id(const int elem_id) const { return process[elem_id]; }
-
-  // process-local element IDS (for all elements)
-  std::vector<int> element;
-
-  // process owning each element (for all elements)
-  std::vector<int> process;
+  int processor_id(const int elem_id) const
+  {
+    return std::upper_bound(offsets.begin(), offsets.end(), elem_id) - offsets.begin() - 1;
+  }
 
-  // sideset IDs corresponding to the faces of each element (for all elements)
+  // sideset IDs corresponding to the faces of each element (for this rank's elements)
   std::vector<int> boundary;
 
   // number of elements owned by each process
@@ -51,7 +53,11 @@ public:
   // number of MOOSE mirror elements owned by each process
   std::vector<int> mirror_counts;
 
-  // number of faces on a boundary of interest for each element
+  // global ID of the first element owned by each process, followed by the total number of
+  // elements
+  std::vector<int> offsets;
+
+  // number of faces on a boundary of interest for each element (for this rank's elements)
   std::vector<int> n_faces_on_boundary;
 
   // number of coupling elements owned by this process
@@ -59,4 +65,7 @@ public:
 
   // total number of coupling elements
   int total_n_elems = 0;
+
+  // global ID of the first element owned by this process
+  int offset = 0;
 };
@@ -0,0 +1,46 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+#include "NekBase.h"
+
+/**
+ * Display the number of bytes of the nrs->usrwrk array copied from host to device
+ * in the most recent data transfer to NekRS, summed over all ranks. Only the parts
+ * of usrwrk written by the incoming transfers are copied.
+ */
+class NekUsrWrkBytesCopied : public GeneralPostprocessor, public NekBase
+{
+public:
+  static InputParameters validParams();
+
+  NekUsrWrkBytesCopied(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+
+  virtual Real getValue() const override { return _bytes; }
+
+protected:
+  /// Number of bytes copied
+  Real _bytes;
+};
@@ -0,0 +1,45 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+#include "OpenMCBase.h"
+
+/**
+ * Get the number of cells whose temperature or density was updated in OpenMC
+ * in the most recent transfer, i.e. the cells whose value changed by more than
+ * the update tolerance set on the problem.
+ */
+class OpenMCUpdatedCells : public GeneralPostprocessor, public OpenMCBase
+{
+public:
+  static InputParameters validParams();
+
+  OpenMCUpdatedCells(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+
+  virtual Real getValue() const override;
+
+protected:
+  /// Which field to report the number of updated cells for
+  const MooseEnum & _field;
+};
@@ -73,8 +73,8 @@ protected:
    */
   std::vector<OpenMCCellAverageProblem::cellInfo> getTallyCells() const;
 
-  /// Whether a cell index, instance pair should be added to the tally filter
-  std::map<OpenMCCellAverageProblem::cellInfo, bool> _cell_has_tally;
+  /// Whether each mapped cell (indexed by cell slot) should be added to the tally filter
+  std::vector<bool> _cell_has_tally;
 
   /// OpenMC mesh filter for this unstructured mesh tally.
   openmc::CellInstanceFilter * _cell_filter;
@@ -82,6 +82,22 @@ protected:
    */
   void checkMeshTemplateAndTranslations();
 
+  /// Add the mesh bins which map to elements local to this rank, for writing results
+  void addLocalBins();
+
+  /**
+   * Get the first translated copy of this mesh tally, which owns the OpenMC mesh
+   * shared by all of the translated copies
+   * @return first translated copy
+   */
+  const MeshTally & firstTranslation() const;
+
+  /**
+   * Assemble a replicated copy of the tallied elements of a distributed [Mesh] on every rank,
+   * and map the bins of the copy back to the element IDs in the [Mesh]
+   */
+  void buildTallyMesh();
+
   /**
    * Mesh template file to use for creating mesh tallies in OpenMC; currently, this mesh
    * must be identical to the mesh used in the [Mesh] block because a simple copy transfer
@@ -99,7 +115,7 @@ protected:
   /// The index into an array of mesh translations.
   const unsigned int _instance;
 
-  /// The index of the mesh added by this tally.
+  /// The index of the mesh used by this tally, which is shared by all translated copies.
   unsigned int _mesh_index;
 
   /// OpenMC mesh filter for this unstructured mesh tally.
@@ -112,10 +128,9 @@ protected:
   const bool _use_dof_map;
 
   /**
-   * For use with block restriction only. A copy of the mesh is made which only contains elements in
-   * the blocks the user wishes to tally on. This is necessary at the moment as the point locators
-   * used in OpenMC to find collision sites are not passed a set of block IDs to filter elements.
-   * TODO: Fix this in OpenMC
+   * For use with distributed meshes only. A replicated copy of the mesh is made which only contains
+   * the elements in the blocks the user wishes to tally on, because OpenMC needs the entire tally
+   * mesh on every rank.
    */
   std::unique_ptr<libMesh::ReplicatedMesh> _libmesh_mesh_copy;
   /// A mapping between the OpenMC bins (active block restricted elements) and all elements.
@@ -278,14 +278,37 @@ protected:
                                  bool norm_by_src_rate = true) = 0;
 
   /**
-   * Set an auxiliary elemental variable to a specified value
+   * Add a spatial bin which maps to elements local to this rank; derived classes call this
+   * when creating their spatial filter so that results are only written to local elements
+   * @param[in] bin index of the bin in the spatial filter
+   * @param[in] volume volume the bin is divided by to form a volumetric tally (MOOSE units)
+   * @param[in] elems local elements which the bin maps to
+   */
+  void addLocalBin(unsigned int bin, Real volume, const std::vector<const Elem *> & elems);
+
+  /**
+   * Get the aux variable degrees of freedom of the local bin elements, which are
+   * computed on first use for each variable
    * @param[in] var_num variable number
-   * @param[in] elem_ids element IDs to set
-   * @param[in] value value to set
+   * @return degrees of freedom, in the order of the local bin elements
+   */
+  const std::vector<numeric_index_type> & localBinDofs(unsigned int var_num);
+
+  /**
+   * Store tally results into auxvariables for the local bins, with a single vectorized
+   * write per variable
+   * @param[in] var_numbers variables which the tally will store results in
+   * @param[in] local_score index into the tally's local array of scores
+   * @param[in] tally_vals the tally values to store
+   * @param[in] n_bins number of spatial bins in the tally
+   * @param[in] norm_by_src_rate whether tally_vals should be normalized by the source rate
+   * @return the sum of the tally over all bins
    */
-  void fillElementalAuxVariable(const unsigned int & var_num,
-                                const std::vector<unsigned int> & elem_ids,
-                                const Real & value);
+  Real storeLocalBins(const std::vector<unsigned int> & var_numbers,
+                      unsigned int local_score,
+                      const std::vector<OMCTensor> & tally_vals,
+                      unsigned int n_bins,
+                      bool norm_by_src_rate);
 
   /**
    * Applies triggers to a tally. This is often the local tally wrapped by this object.
@@ -326,6 +349,24 @@ protected:
   /// The external filters added in the [Problem/Filters] block.
   std::vector<std::shared_ptr<FilterBase>> _ext_filters;
 
+  /// Spatial bins which map to at least one element local to this rank
+  std::vector<unsigned int> _local_bins;
+
+  /// Volume of each local bin, in the units of the [Mesh]
+  std::vector<Real> _local_bin_volumes;
+
+  /// Offsets into '_local_bin_elems' for each local bin
+  std::vector<unsigned int> _local_bin_offsets;
+
+  /// Local elements which each local bin maps to
+  std::vector<const Elem *> _local_bin_elems;
+
+  /// Degrees of freedom of the local bin elements, for each variable written so far
+  std::unordered_map<unsigned int, std::vector<numeric_index_type>> _local_bin_dofs;
+
+  /// Scratch space for the values written to the local bin elements
+  std::vector<Real> _local_bin_values;
+
   /// The OpenMC estimator to use with this tally.
   openmc::TallyEstimator _estimator;
 
@@ -49,6 +49,12 @@ public:
     return _field_usrwrk_scales;
   }
 
+  /**
+   * Get the internal numbers of the variable(s) created in MOOSE for this transfer
+   * @return map ordered as (name, number)
+   */
+  const std::map<std::string, unsigned int> & variableNumbers() const { return _variable_number; }
+
 protected:
   /**
    * Fill an outgoing auxiliary variable field with nekRS solution data
@@ -108,6 +114,9 @@ protected:
   /// MOOSE data interpolated onto the (volume) data transfer mesh
   double * _v_elem = nullptr;
 
+  /// MOOSE data on the (volume) data transfer mesh for all of the volume elements on this rank
+  std::vector<double> _v_elems;
+
   /// Scratch space to place external NekRS fields before writing into auxiliary variables
   double * _external_data = nullptr;
 };
@@ -31,6 +31,9 @@ public:
 
   virtual void threadJoin(const UserObject & /* uo */) override {}
 
+  /// Flag that the MOAB mesh must be re-built because the [Mesh] changed, such as by adaptivity
+  virtual void meshChanged() override { _mesh_changed = true; }
+
   /**
    * Wrap the error handling in MOAB to print errors to user
    * @param[in] input MOAB error code
@@ -116,7 +119,7 @@ public:
   unsigned int getAuxiliaryVariableNumber(const std::string & name,
                                           const std::string & param_name) const;
 
-  /// Clear mesh data
+  /// Clear mesh data, so that the MOAB mesh is re-built on the next skinning operation
   void reset();
 
   /**
@@ -161,6 +164,13 @@ public:
    */
   const std::shared_ptr<moab::Interface> & moabPtr() const { return _moab; }
 
+  /**
+   * Build the implicit complement and the OBB trees of all surfaces and volumes which do not
+   * have one (because they are new, or their triangles changed), so that DagMC can re-use
+   * the trees of the unchanged geometry
+   */
+  void buildOBBTrees();
+
 protected:
   /// Boundary condition types that can be assigned to DAGMC surfaces
   enum class BoundaryConditionType
@@ -170,7 +180,11 @@ protected:
     Reflective
   };
 
-  std::unique_ptr<NumericVector<Number>> _serialized_solution;
+  /// Auxiliary solution, holding only the values of the binning variables on every element
+  std::unique_ptr<NumericVector<Number>> _localized_solution;
+
+  /// Auxiliary dofs of the binning variables on every element, sorted
+  std::vector<dof_id_type> _localized_dofs;
 
   /// MOAB interface
   std::shared_ptr<moab::Interface> _moab;
@@ -233,6 +247,15 @@ protected:
   /// Whether the skinned mesh should be generated from a displaced mesh
   bool _use_displaced;
 
+  /// Whether to keep the MOAB mesh between skinning operations and only re-skin changed bins
+  const bool & _incremental;
+
+  /// Whether the MOAB vertices and tets have been built (and can be re-used)
+  bool _moab_mesh_built;
+
+  /// Whether the [Mesh] changed since the MOAB mesh was built
+  bool _mesh_changed;
+
   /// Length multiplier to get from [Mesh] units into OpenMC's centimeters
   Real _scaling;
 
@@ -245,7 +268,7 @@ protected:
   /// True when buildTetMesh() is called
   bool _tet_mesh_built;
 
-  /// TET4 clone of the MOOSE mesh. Present only when the source mesh contains non-tetrahedral elements. Rebuilt each update() cycle.
+  /// TET4 clone of the MOOSE mesh. Present only when the source mesh contains non-tetrahedral elements. Rebuilt with the MOAB mesh.
   std::unique_ptr<MeshBase> _tet_mesh;
 
   /// Encode the whether the surface normal faces into or out of the volume
@@ -262,6 +285,14 @@ protected:
     Sense sense;
   };
 
+  /// Tets and skin of a volume, needed to re-create its surfaces when a neighboring bin changes
+  struct VolSkin
+  {
+    moab::Range region;
+    moab::Range forward_tris;
+    moab::Range reversed_tris;
+  };
+
   /// Get the MooseMesh (displaced or not, depending on _use_displaced)
   MooseMesh & getMooseMesh();
 
@@ -275,6 +306,24 @@ protected:
   /// If the mesh has non-tetrahedral elements, clone it into _tet_mesh and convert to all-TET4
   void buildTetMesh();
 
+  /**
+   * Whether the MOAB mesh built previously can be re-used for the current [Mesh]
+   * @return whether the MOAB mesh must be re-built
+   */
+  bool mustRebuildMOABMesh() const;
+
+  /// Create the MOAB tags, vertices and tets from the [Mesh]
+  void buildMOABMesh();
+
+  /// Store the face neighbors of each element in the geometry mesh in a flat array
+  void buildNeighborGraph();
+
+  /// Move the MOAB vertices (and the graveyard) to the current node positions
+  void updateMOABCoordinates();
+
+  /// Find the auxiliary dofs read to bin the elements, and size the localized solution
+  void initializeLocalizedSolution();
+
   /**
    * Copy the libMesh [Mesh] into a MOAB mesh. This first loops through all of the
    * nodes, and rebuilds each as a MOAB vertex. Then, we loop over all of the elements
@@ -307,7 +356,8 @@ protected:
                   const std::vector<VolData> & voldata,
                   BoundaryConditionType bc_type = BoundaryConditionType::Transmission);
 
-  /// Helper method to create MOAB surfaces with no overlaps; bc_type is recorded on
+  /// Helper method to create MOAB surfaces with no overlaps, finding the surfaces which
+  /// already contain each face in one pass over the faces; bc_type is recorded on
   /// every surface created or matched by this call
   void createSurfaces(moab::Range & faces,
                       VolData & voldata,
@@ -386,9 +436,37 @@ protected:
   /// Sort all the elements in the [Mesh] into bins for temperature, density, and subdomain.
   virtual void sortElemsByResults();
 
-  /// Group the binned elems into local temperature regions and find their surfaces
+  /// Group the binned elems into local temperature regions and find their surfaces,
+  /// only for the bins whose elements changed since the previous skinning operation
   void findSurfaces();
 
+  /**
+   * Delete the volumes of the changed bins and all surfaces bounding them, and re-create
+   * the surfaces of the kept volumes which were shared with a deleted volume
+   * @param[in] changed whether each bin changed since the previous skinning operation
+   */
+  void removeBins(const std::vector<bool> & changed);
+
+  /// Delete the implicit complement (and its OBB tree) which DagMC adds to the
+  /// MOAB database, so that it is re-created for the updated geometry
+  void removeDAGMCData();
+
+  /// Delete the OBB trees of all surfaces and volumes
+  void deleteOBBTrees();
+
+  /**
+   * Delete the OBB tree of a surface or volume, if it has one; for a volume, the trees of
+   * its surfaces are kept
+   * @param[in] set surface or volume
+   */
+  void deleteOBBTree(moab::EntityHandle set);
+
+  /**
+   * Delete the OBB trees of a surface and all volumes it bounds, before it is modified
+   * @param[in] surf surface
+   */
+  void invalidateOBBTrees(moab::EntityHandle surf);
+
   /**
    * Convert sideset names or numeric IDs to mesh BoundaryIDs and validate that each
    * is a sideset. Both string names and integer IDs are accepted.
@@ -475,15 +553,53 @@ protected:
    */
   std::string boundaryConditionGroupName(BoundaryConditionType bc_type) const;
 
-  /// Group a given bin into local regions
-  /// NB elems in param is a copy, localElems is a reference
-  void groupLocalElems(std::set<dof_id_type> elems, std::vector<moab::Range> & localElems);
+  /**
+   * Group the elements in a bin into connected regions with a union-find over the
+   * face neighbors; regions are ordered by their lowest element ID. Bins touch
+   * disjoint entries in 'parent', so different bins may be grouped concurrently.
+   * @param[in] bin bin index
+   * @param[in] bin_of_elem bin index of each element in the geometry mesh
+   * @param[in] parent union-find parent of each element in the geometry mesh
+   * @param[out] localElems MOAB tets in each region
+   */
+  void groupLocalElems(unsigned int bin,
+                       const std::vector<unsigned int> & bin_of_elem,
+                       std::vector<dof_id_type> & parent,
+                       std::vector<moab::Range> & localElems) const;
 
   /// Clear MOAB entity sets
   bool resetMOAB();
 
-  /// Find the surfaces for the provided range and add to group
-  void findSurface(const moab::Range & region,
+  /**
+   * Find the skin of each region in the changed bins. The bins are split across ranks, and
+   * the skins are then shared with every rank as the vertices of their tris
+   * @param[in] changed_bins bins to skin, in increasing order
+   * @param[in] bin_regions MOAB tets in each region of each bin
+   * @param[out] bin_skins tets and skin of each region of each bin
+   */
+  void skinRegions(const std::vector<unsigned int> & changed_bins,
+                   const std::vector<std::vector<moab::Range>> & bin_regions,
+                   std::vector<std::vector<VolSkin>> & bin_skins);
+
+  /**
+   * Append the vertices of tris to a flat array, oriented outwards from the skinned region
+   * @param[in] tris tris
+   * @param[in] reversed whether the tris are reversed with respect to the region
+   * @param[out] conn vertices of each tri
+   */
+  void appendSkinConnectivity(const moab::Range & tris,
+                              bool reversed,
+                              std::vector<moab::EntityHandle> & conn) const;
+
+  /**
+   * Find (or create) the tri with the given vertices, and add it to a skin
+   * @param[in] conn vertices of the tri, oriented outwards from the skinned region
+   * @param[out] skin skin of the region
+   */
+  void addSkinTri(const moab::EntityHandle * conn, VolSkin & skin);
+
+  /// Create a volume for a skinned region and its surfaces, and add the volume to group
+  void findSurface(const VolSkin & skin,
                    moab::EntityHandle group,
                    unsigned int & vol_id,
                    unsigned int & surf_id,
@@ -544,6 +660,33 @@ protected:
   /// Mapping from total bin ID to a set of elements sorted into that bin
   std::vector<std::set<dof_id_type>> _elem_bins;
 
+  /// Elements sorted into each bin in the previous skinning operation
+  std::vector<std::set<dof_id_type>> _previous_elem_bins;
+
+  /// Group entity set for each bin
+  std::vector<moab::EntityHandle> _bin_groups;
+
+  /// Volume entity sets in each bin
+  std::vector<std::vector<moab::EntityHandle>> _bin_volumes;
+
+  /// Tets and skin of each volume entity set (other than the graveyard)
+  std::map<moab::EntityHandle, VolSkin> _vol_skins;
+
+  /// Counter for volume IDs, which keeps increasing across incremental skinning operations
+  unsigned int _vol_id;
+
+  /// Counter for surface IDs, which keeps increasing across incremental skinning operations
+  unsigned int _surf_id;
+
+  /// Vertices of the graveyard surfaces, paired with the bounding box multiplier of each surface
+  std::vector<std::pair<Real, std::vector<moab::EntityHandle>>> _graveyard_vertices;
+
+  /// Group entity set assigning a material to the implicit complement
+  moab::EntityHandle _implicit_complement_group;
+
+  /// Group entity sets assigning boundary conditions to surfaces
+  std::vector<moab::EntityHandle> _bc_groups;
+
   /// Blocks in the [Mesh]
   std::map<SubdomainID, unsigned int> _blocks;
 
@@ -553,12 +696,30 @@ protected:
   /// Save some topological data: map from surface handle to vol handle and sense
   std::map<moab::EntityHandle, std::vector<VolData>> surfsToVols;
 
+  /// Map from a tri handle to the surface which contains it
+  std::unordered_map<moab::EntityHandle, moab::EntityHandle> _tri_to_surf;
+
+  /// Offset into _neighbors of the first face neighbor of each element (indexed by element ID)
+  std::vector<std::size_t> _neighbor_offsets;
+
+  /// Face neighbors (element IDs) of all elements in the geometry mesh
+  std::vector<dof_id_type> _neighbors;
+
   /// Tag for dimension for geometry
   moab::Tag geometry_dimension_tag;
 
   /// Tag for entitiy set ID
   moab::Tag id_tag;
 
+  /// Tag for the OBB tree root of a surface or volume
+  moab::Tag obb_root_tag;
+
+  /// Tag for the surface or volume of an OBB tree root
+  moab::Tag obb_gset_tag;
+
+  /// OBB tree roots of the surfaces
+  std::set<moab::EntityHandle> _surface_obb_roots;
+
   /// Tag for faceting tolerance
   moab::Tag faceting_tol_tag;
 
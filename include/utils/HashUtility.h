@@ -0,0 +1,47 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+
+#pragma once
+
+#include "Moose.h"
+
+namespace hash_utility
+{
+
+/// Initial value for the FNV-1a hash
+static constexpr uint64_t FNV_OFFSET{14695981039346656037ULL};
+
+/**
+ * Hash a sequence of bytes with the 64-bit FNV-1a algorithm, which is not
+ * cryptographic but is stable across platforms and runs
+ * @param[in] data bytes to hash
+ * @param[in] n number of bytes
+ * @param[in] hash hash to continue from
+ * @return hash
+ */
+uint64_t fnv1a(const void * data, std::size_t n, uint64_t hash = FNV_OFFSET);
+
+/**
+ * Hash the contents of a file
+ * @param[in] filename file to hash
+ * @param[in] hash hash to continue from
+ * @return hash
+ */
+uint64_t hashFile(const std::string & filename, uint64_t hash = FNV_OFFSET);
+
+} // end of namespace hash_utility
@@ -47,5 +47,5 @@
 
 [Outputs]
   csv = true
-  hide = 'k k_residual critical_value'
+  hide = 'k k_residual critical_value critical_search_runs'
 []
@@ -0,0 +1,63 @@
+[Mesh]
+  [g]
+    type = GeneratedMeshGenerator
+    dim = 3
+    xmin = 0
+    xmax = 10
+    ymin = 0
+    ymax = 10
+    zmin = 0
+    zmax = 10
+  []
+[]
+
+[Problem]
+  type = OpenMCCellAverageProblem
+
+  [CriticalitySearch]
+    type = OpenMCMaterialDensity
+    material_id = 1
+    minimum = 10000
+    maximum = 20000
+    root_tol = 100
+    k_tol = 1e-2
+    warm_start = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+[]
+
+[Postprocessors]
+  [k]
+    type = KEigenvalue
+  []
+  [k_residual]
+    type = ParsedPostprocessor
+    expression = 'abs(k - 1.0)'
+    pp_names = 'k'
+  []
+  [k_converged_within_tolerance]
+    type = ParsedPostprocessor
+    expression = 'if (k_residual < 1e-2, 1, 0)'
+    pp_names = 'k_residual'
+  []
+
+  # the second search starts from the root of the first, so it needs fewer OpenMC runs
+  [change_in_runs]
+    type = ChangeOverTimePostprocessor
+    postprocessor = critical_search_runs
+  []
+  [fewer_runs]
+    type = ParsedPostprocessor
+    expression = 'if (change_in_runs < 0, 1, 0)'
+    pp_names = 'change_in_runs'
+  []
+[]
+
+[Outputs]
+  csv = true
+  hide = 'k k_residual critical_value critical_search_runs change_in_runs'
+[]
@@ -31,7 +31,7 @@
 []
 
 [Outputs]
-  hide := 'k k_residual critical_value k_converged_within_tolerance'
+  hide := 'k k_residual critical_value critical_search_runs k_converged_within_tolerance'
   execute_on = 'TIMESTEP_END'
 []
 
@@ -0,0 +1,12 @@
+!include box-test.i
+
+# Run one time step with a first-order mesh mirror in NekRS
+[Executioner]
+  end_time := 1
+[]
+
+[MultiApps]
+  [nek]
+    input_files := 'nek_first_order.i'
+  []
+[]
@@ -0,0 +1,85 @@
+# Same as nek.i, but with a first-order mesh mirror, so that the displacements are
+# interpolated from the mirror onto the second-order NekRS mesh. The areas and volume
+# are computed on the NekRS mesh.
+[Mesh]
+  type = NekRSMesh
+  order = FIRST
+  volume = true
+  parallel_type = replicated
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Problem]
+  type = NekRSProblem
+  casename = 'nekbox'
+  n_usrwrk_slots = 4
+
+  [FieldTransfers]
+    [heat_source]
+      type = NekVolumetricSource
+      direction = to_nek
+      usrwrk_slot = 0
+      postprocessor_to_conserve = source_integral
+    []
+    [disp]
+      type = NekMeshDeformation
+      usrwrk_slot = '1 2 3'
+      direction = to_nek
+    []
+    [temp]
+      type = NekFieldVariable
+      field = temperature
+      direction = from_nek
+    []
+  []
+[]
+
+[Executioner]
+  type = Transient
+  [TimeStepper]
+    type = NekTimeStepper
+  []
+[]
+
+[Postprocessors]
+  [nek_ar1]
+    type = NekSideIntegral
+    field = unity
+    boundary = '1'
+  []
+  [nek_ar2]
+    type = NekSideIntegral
+    field = unity
+    boundary = '2'
+  []
+  [nek_ar3]
+    type = NekSideIntegral
+    field = unity
+    boundary = '3'
+  []
+  [nek_ar4]
+    type = NekSideIntegral
+    field = unity
+    boundary = '4'
+  []
+  [nek_ar5]
+    type = NekSideIntegral
+    field = unity
+    boundary = '5'
+  []
+  [nek_ar6]
+    type = NekSideIntegral
+    field = unity
+    boundary = '6'
+  []
+  [nek_volume]
+    type = NekVolumeIntegral
+    field = unity
+  []
+[]
+
+[Outputs]
+  csv = true
+  execute_on = 'final'
+  hide = 'source_integral heat_source'
+[]
@@ -0,0 +1,126 @@
+[Mesh]
+  [sphere]
+    type = FileMeshGenerator
+    file = ../meshes/sphere.e
+  []
+  [solid]
+    type = CombinerGenerator
+    inputs = sphere
+    positions = '0 0 0'
+  []
+  [solid_ids]
+    type = SubdomainIDGenerator
+    input = solid
+    subdomain_id = '100'
+  []
+[]
+
+[Adaptivity]
+  steps = 1
+  max_h_level = 1
+  marker = uniform
+
+  [Markers/uniform]
+    type = UniformMarker
+    mark = refine
+  []
+[]
+
+[AuxVariables]
+  [cell_temperature]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [cell_density]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+[]
+
+# the temperature and density change in time so that any cells which were not
+# updated after the mesh was refined keep the values from the first time step
+[Functions]
+  [temp]
+    type = ParsedFunction
+    expression = 'if (z < 2.0, 600.0, if (z < 6.0, 650.0, 700.0)) + 10.0 * t'
+  []
+  [rho]
+    type = ParsedFunction
+    expression = 'if (z < 2.0, 5000.0, if (z < 6.0, 5500.0, 6000.0)) + 100.0 * t'
+  []
+[]
+
+[AuxKernels]
+  [temp]
+    type = FunctionAux
+    variable = temp
+    function = temp
+    execute_on = timestep_begin
+  []
+  [rho]
+    type = FunctionAux
+    variable = density
+    function = rho
+    execute_on = timestep_begin
+  []
+  [cell_temperature]
+    type = CellTemperatureAux
+    variable = cell_temperature
+  []
+  [cell_density]
+    type = CellDensityAux
+    variable = cell_density
+  []
+[]
+
+[Problem]
+  type = OpenMCCellAverageProblem
+  verbose = true
+  temperature_blocks = '100'
+  density_blocks = '100'
+  cell_level = 0
+  incremental_remap = true
+[]
+
+[Postprocessors]
+  [rho_0]
+    type = PointValue
+    variable = cell_density
+    point = '0.0 0.0 0.0'
+  []
+  [rho_4]
+    type = PointValue
+    variable = cell_density
+    point = '0.0 0.0 4.0'
+  []
+  [rho_8]
+    type = PointValue
+    variable = cell_density
+    point = '0.0 0.0 8.0'
+  []
+  [temp_0]
+    type = PointValue
+    variable = cell_temperature
+    point = '0.0 0.0 0.0'
+  []
+  [temp_4]
+    type = PointValue
+    variable = cell_temperature
+    point = '0.0 0.0 4.0'
+  []
+  [temp_8]
+    type = PointValue
+    variable = cell_temperature
+    point = '0.0 0.0 8.0'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+[]
+
+[Outputs]
+  csv = true
+  execute_on = timestep_end
+[]
@@ -0,0 +1,70 @@
+!include mesh.i
+
+# The temperature alternates between two values, so that the multi-group library is read
+# for each of the first two temperatures and then kept in memory for the rest
+[Functions]
+  [temp]
+    type = ParsedFunction
+    expression = 'if (t < 1.5, 400.0, if (t < 2.5, 500.0, if (t < 3.5, 400.0, 500.0)))'
+  []
+[]
+
+[AuxVariables]
+  [cell_temperature]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+[]
+
+[AuxKernels]
+  [temp]
+    type = FunctionAux
+    variable = temp
+    function = temp
+    execute_on = timestep_begin
+  []
+  [cell_temperature]
+    type = CellTemperatureAux
+    variable = cell_temperature
+  []
+[]
+
+[Problem]
+  type = OpenMCCellAverageProblem
+  verbose = true
+  source_strength = 1e6
+  xml_directory = './nearest'
+
+  cell_level = 0
+  temperature_blocks = '0'
+
+  particles = 100
+  batches = 10
+  inactive_batches = 0
+
+  [Tallies]
+    [heating]
+      type = CellTally
+      score = 'flux'
+      check_tally_sum = false
+    []
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1.0
+  num_steps = 4
+[]
+
+[Postprocessors]
+  [max_cell_temperature]
+    type = ElementExtremeValue
+    variable = cell_temperature
+  []
+[]
+
+[Outputs]
+  csv = true
+  execute_on = 'TIMESTEP_END'
+[]
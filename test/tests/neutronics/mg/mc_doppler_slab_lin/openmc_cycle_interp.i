@@ -0,0 +1,13 @@
+!include openmc_cycle.i
+
+# The higher temperature lies in the last interval of the library, so that interpolating
+# requires the highest library temperature
+[Functions]
+  [temp]
+    expression := 'if (t < 1.5, 400.0, if (t < 2.5, 1195.0, if (t < 3.5, 400.0, 1195.0)))'
+  []
+[]
+
+[Problem]
+  xml_directory := './interp'
+[]
@@ -0,0 +1,67 @@
+[Mesh]
+  [load]
+    type = FileMeshGenerator
+    file = ../../neutronics/meshes/pincell.e
+  []
+[]
+
+[AuxVariables]
+  [cell_temperature]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+[]
+
+[AuxKernels]
+  [temp]
+    type = FunctionAux
+    variable = temp
+    function = temp
+    execute_on = timestep_begin
+  []
+  [cell_temperature]
+    type = CellTemperatureAux
+    variable = cell_temperature
+  []
+[]
+
+[Functions]
+  [temp]
+    type = ParsedFunction
+    expression = '600.0 + 0.5 * t'
+  []
+[]
+
+[Problem]
+  type = OpenMCCellAverageProblem
+  power = 500.0
+  cell_level = 0
+  verbose = true
+
+  temperature_blocks = '1 2 3'
+
+  # the temperature changes by 0.5 K per time step, so that the cells are only
+  # re-sent to OpenMC on every other time step
+  temperature_update_tolerance = 1.0
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+[]
+
+[Postprocessors]
+  [updated_cells]
+    type = OpenMCUpdatedCells
+    field = temperature
+  []
+  [openmc_temp]
+    type = PointValue
+    variable = cell_temperature
+    point = '0.1 0.05 0.55'
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,21 @@
+!include flux.i
+
+# The flux is only written on the 17 NekRS elements on boundary 2, so only those
+# elements should be copied to the device, for each slot (2 * 17 * 8 GLL points * 8 bytes).
+# The point values are interpolated from the device copy of usrwrk, at the center of a
+# face on boundary 2, and equal the flux integrals divided by the area of boundary 2.
+[Postprocessors]
+  [bytes_copied]
+    type = NekUsrWrkBytesCopied
+  []
+  [device_usrwrk00]
+    type = NekPointValue
+    field = usrwrk00
+    point = '0.180650573 0.0296807698 0.471347985'
+  []
+  [device_usrwrk01]
+    type = NekPointValue
+    field = usrwrk01
+    point = '0.180650573 0.0296807698 0.471347985'
+  []
+[]
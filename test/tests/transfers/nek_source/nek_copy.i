@@ -0,0 +1,20 @@
+!include nek.i
+
+# The sources are written on all 323 NekRS elements (2 * 323 * 8 GLL points * 8 bytes).
+# The point values are interpolated from the device copy of usrwrk, at the centroid of
+# an element, and equal the source integrals divided by the NekRS volume.
+[Postprocessors]
+  [bytes_copied]
+    type = NekUsrWrkBytesCopied
+  []
+  [device_usrwrk00]
+    type = NekPointValue
+    field = usrwrk00
+    point = '-0.02201314 -0.13729626 0.21695886'
+  []
+  [device_usrwrk01]
+    type = NekPointValue
+    field = usrwrk01
+    point = '-0.02201314 -0.13729626 0.21695886'
+  []
+[]